@@ -0,0 +1,70 @@
+// Example sketch for ICM7218 library
+// https://github.com/Andy4495/ICM7218
+//
+// Splits the display into three regions which are updated at different rates.
+// Written for the C/D variants. With an ICM7228A/B or Maxim ICM7218A/B, use
+// the A/B constructor and call setSingleDigitUpdate(true) in setup().
+//
+// 1.4.0    18-Oct-2026 Andy4495 Initial version
+
+#include "ICM7218.h"
+
+// Constructor: Confirm/update these pin numbers match your Arduino->ICM7x28 connection
+// Note that on ATmega328: 17=A3, 16=A2, 15=A1, 14=A0
+//      myLED(ID0, ID1, ID2, ID3, ID7, DA0, DA1, DA2, mode, write, CD); // Constructor form for C/D variants of chip
+ICM7218 myLED( 19,  18,  13,  12,   6,   9,  10,  11,    2,     5,  1); // Update per your configuration
+
+#define TEMP_DELAY     200UL
+#define CHANNEL_DELAY 5000UL
+unsigned long tempMillis;
+unsigned long channelMillis;
+
+byte temp_region, channel_region, status_region;
+int temperature = 0;
+int channel = 1;
+char buffer[8];
+
+void setup() {
+
+  Serial.begin(9600);
+  Serial.println("ICM7218 Library display regions example.");
+
+  myLED.setMode(ICM7218::CODEB);
+  myLED = "        ";
+  myLED.dots = 0;
+  myLED.print();
+
+  temp_region    = myLED.defineRegion(0, 4, ICM7218::RIGHT_JUSTIFY);
+  channel_region = myLED.defineRegion(4, 2, ICM7218::RIGHT_JUSTIFY);
+  status_region  = myLED.defineRegion(6, 2);
+
+  myLED.setRegionDots(temp_region, 0x02);   // Temperature displayed with one decimal place
+  snprintf(buffer, sizeof(buffer), "%02d", temperature);
+  myLED.printRegion(temp_region, buffer);
+  snprintf(buffer, sizeof(buffer), "%d", channel);
+  myLED.printRegion(channel_region, buffer);
+  myLED.printRegion(status_region, "HE");
+
+  tempMillis = millis();
+  channelMillis = millis();
+}
+
+void loop() {
+  // Temperature changes quickly; only its 4 digits are sent to the display
+  if (millis() - tempMillis > TEMP_DELAY) {
+    temperature = (temperature + 7) % 1000;
+    snprintf(buffer, sizeof(buffer), "%02d", temperature);  // Keep a digit before the decimal point
+    myLED.printRegion(temp_region, buffer);
+    tempMillis = millis();
+  }
+
+  // Channel changes slowly
+  if (millis() - channelMillis > CHANNEL_DELAY) {
+    channel = (channel % 16) + 1;
+    snprintf(buffer, sizeof(buffer), "%d", channel);
+    myLED.printRegion(channel_region, buffer);
+    Serial.print("Channel: ");
+    Serial.println(channel);
+    channelMillis = millis();
+  }
+}
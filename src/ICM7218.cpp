@@ -19,6 +19,8 @@
                                Renamed segment_map to ICM7218_segment_map
    1.3.0    08/24/2022  Andy4495 Add methods to simplify usage
    1.3.2    05-Dec-2023 Andy4495 Fix issues with C/D variants
+   1.4.0    18-Oct-2026 Andy4495 print(const char*) supports C/D variants
+                               Add display regions with per-region update
 */
 
 #include "ICM7218.h"
@@ -70,6 +72,9 @@ ICM7218::ICM7218(byte ID0_pin, byte ID1_pin, byte ID2_pin, byte ID3_pin,
   mode = CODEB;            // Default mode is CODEB decode until changed with setMode()
   power_state = WAKEUP;    // Default power state is active until changed with shutdown()
   ram_bank_select = RAM_BANK_A;   // Only useful on ICM7228
+  sent_valid = 0;          // Chip RAM contents unknown until each digit is written
+  single_digit_update = 0; // Intersil ICM7218A/B do not support Single Digit Update mode
+  num_regions = 0;
   ab_or_cd = CHIP_AB;
 } // Constructor for A or B chip variant
 
@@ -119,6 +124,9 @@ ICM7218::ICM7218(byte ID0_pin, byte ID1_pin, byte ID2_pin, byte ID3_pin, byte ID
   mode = CODEB;            // Default mode is CODEB decode until changed with setMode()
   power_state = WAKEUP;    // Default power state is active until changed with shutdown()
   ram_bank_select = RAM_BANK_A;   // Only useful on ICM7228
+  sent_valid = 0;          // Chip RAM contents unknown until each digit is written
+  single_digit_update = 1; // C/D variants only support single digit writes
+  num_regions = 0;
   ab_or_cd = CHIP_CD | (chip_cd & 0x01);  // Obfuscated code to avoid an "unused parameter" warning from compiler
 } // Constructor for C or D variant
 
@@ -160,6 +168,9 @@ void ICM7218::setMode(CHAR_MODE m) {
     // re-send DIRECT control word with HEXA bit to avoid CODEB flash on LEDs
     if ( (mode == DIRECT) && (m == HEXA) )
       send_control(NO_DATA_COMING, hexa_codeb_bit, 1, power_state);
+    // New mode only reaches the chip with the next control word, so no digit
+    // can be skipped as unchanged until it has been re-sent
+    sent_valid = 0;
   }
   else {  // C or D chip variant. No control word; update MODE pin.
     if (power_state == WAKEUP) {
@@ -185,114 +196,133 @@ void ICM7218::setMode(CHAR_MODE m) {
 
 void ICM7218::setBank(RAM_BANK bs) {
   ram_bank_select = bs;
+  sent_valid = 0;   // Contents of the newly selected bank are unknown
 }
 
-// This method only works with the A and B variants of the chip
+// Only has an effect on the A and B variants. Enable when using an ICM7228A/B
+// or Maxim ICM7218A/B
+// so that flushRegion() can update single digits instead of the whole display.
+void ICM7218::setSingleDigitUpdate(bool enable) {
+  if (ab_or_cd == CHIP_AB) single_digit_update = enable ? 1 : 0;
+}
+
+/* A and B variants send the whole string in one burst.
+   C and D variants have no burst mode, so only the digits whose value differs
+   from what was last written to that digit address are sent.
+*/
 void ICM7218::print(const char* s) {
   byte outbuf[MAX_DIGITS + 1]; // Extra byte in case there is a leading decimal point (which does not get displayed)
   int index = MAX_DIGITS;
   int i = 0;
-  
-  // This method only works with the A and B variants of the chip
-  if (ab_or_cd == CHIP_AB) {
-    switch (mode) {
-      case HEXA:
-        memset(outbuf, 0 | DP, MAX_DIGITS + 1); // Initialize to default characters (0)
-        while (index > 0) {
-          switch (s[i]) {
-            case '0': case '1': case '2': case '3':  case '4':
-            case '5': case '6': case '7': case '8':  case '9':
-              outbuf[--index] = (s[i] - '0' ) | DP;
-              break;
-            case 'A':  case 'B': case 'C': case 'D': case 'E': case 'F':
-              outbuf[--index] = (s[i] - 'A' + 10) | DP;
-              break;
-            case 'a':  case 'b': case 'c': case 'd': case 'e': case 'f':
-              outbuf[--index] = (s[i] - 'a' + 10) | DP;
-              break;
-            case '.':
-              outbuf[index] = outbuf[index] & ~DP;
-              break;
-            case '\0':      // End of string
-              index = 0;    // This will end the while loop
-              break;
-            default:        // Invalid character, use default character (0)
-              --index;
-              break;
-            }
-          i++;
-        }
-        // Check for a trailing decimal point
-        if (s[i] == '.') outbuf[index] = outbuf[index] & ~DP;
-        break;
 
-      case CODEB:
-        memset(outbuf, 15 | DP, MAX_DIGITS + 1); // Initialize to default characters (<space>)
-        while (index > 0) {
-          switch (s[i]) {
-            case '0':  case '1': case '2': case '3': case '4':
-            case '5':  case '6': case '7': case '8': case '9':
-              outbuf[--index] = (s[i] - '0' ) | DP;
-              break;
-            case 'E':  case 'e':
-              outbuf[--index] = 11 | DP;
-              break;
-            case 'H': case 'h':
-              outbuf[--index] = 12 | DP;
-              break;
-            case 'L': case 'l':
-              outbuf[--index] = 13 | DP;
-              break;
-            case 'P': case 'p':
-              outbuf[--index] = 14 | DP;
-              break;
-            case '-':
-              outbuf[--index] = 10 | DP;
-              break;
-            case ' ':
-              outbuf[--index] = 15 | DP;
-              break;
-            case '.':
-              outbuf[index] = outbuf[index] & ~DP;
-              break;
-            case '\0':     // End of string
-              index = 0;   // This will end the while loop
-              break;
-            default:       // Invalid character printed as a blank
-              --index;
-              break;
+  switch (mode) {
+    case HEXA:
+      memset(outbuf, 0 | DP, MAX_DIGITS + 1); // Initialize to default characters (0)
+      while (index > 0) {
+        switch (s[i]) {
+          case '0': case '1': case '2': case '3':  case '4':
+          case '5': case '6': case '7': case '8':  case '9':
+            outbuf[--index] = (s[i] - '0' ) | DP;
+            break;
+          case 'A':  case 'B': case 'C': case 'D': case 'E': case 'F':
+            outbuf[--index] = (s[i] - 'A' + 10) | DP;
+            break;
+          case 'a':  case 'b': case 'c': case 'd': case 'e': case 'f':
+            outbuf[--index] = (s[i] - 'a' + 10) | DP;
+            break;
+          case '.':
+            outbuf[index] = outbuf[index] & ~DP;
+            break;
+          case '\0':      // End of string
+            index = 0;    // This will end the while loop
+            break;
+          default:        // Invalid character, use default character (0)
+            --index;
+            break;
           }
-          i++;
-        }
-        // Check for a trailing decimal point
-        if (s[i] == '.') outbuf[index] = outbuf[index] & ~DP;
-        break;
+        i++;
+      }
+      // Check for a trailing decimal point (unless the string already ended)
+      if ((s[i - 1] != '\0') && (s[i] == '.')) outbuf[index] = outbuf[index] & ~DP;
+      break;
 
-      case DIRECT:
-        memset(outbuf, 0 | DP, MAX_DIGITS + 1); // Initialize to default characters (0)
-        for (i = 0; i < MAX_DIGITS; i++) {
-          // Previous versions of this library stopped when '\0' was detected
-          // However, '\0' is a valid value in DIRECT mode, so we should process it
-          // Since this is a read-only operation, going beyond end of array will
-          // not corrupt memory.
-          outbuf[MAX_DIGITS - 1 - i] = s[i];  // Flip the bytes around MSB<->LSB
+    case CODEB:
+      memset(outbuf, 15 | DP, MAX_DIGITS + 1); // Initialize to default characters (<space>)
+      while (index > 0) {
+        switch (s[i]) {
+          case '0':  case '1': case '2': case '3': case '4':
+          case '5':  case '6': case '7': case '8': case '9':
+            outbuf[--index] = (s[i] - '0' ) | DP;
+            break;
+          case 'E':  case 'e':
+            outbuf[--index] = 11 | DP;
+            break;
+          case 'H': case 'h':
+            outbuf[--index] = 12 | DP;
+            break;
+          case 'L': case 'l':
+            outbuf[--index] = 13 | DP;
+            break;
+          case 'P': case 'p':
+            outbuf[--index] = 14 | DP;
+            break;
+          case '-':
+            outbuf[--index] = 10 | DP;
+            break;
+          case ' ':
+            outbuf[--index] = 15 | DP;
+            break;
+          case '.':
+            outbuf[index] = outbuf[index] & ~DP;
+            break;
+          case '\0':     // End of string
+            index = 0;   // This will end the while loop
+            break;
+          default:       // Invalid character printed as a blank
+            --index;
+            break;
         }
-        break;
+        i++;
+      }
+      // Check for a trailing decimal point (unless the string already ended)
+      if ((s[i - 1] != '\0') && (s[i] == '.')) outbuf[index] = outbuf[index] & ~DP;
+      break;
 
-      default: // Send all zeroes for invalid mode. THIS SHOULD NEVER HAPPEN!
-        for (i = 0; i < MAX_DIGITS; i++) 
-          outbuf[i] = 0;
-        break;
-    }
+    case DIRECT:
+      memset(outbuf, 0 | DP, MAX_DIGITS + 1); // Initialize to default characters (0)
+      for (i = 0; i < MAX_DIGITS; i++) {
+        // Previous versions of this library stopped when '\0' was detected
+        // However, '\0' is a valid value in DIRECT mode, so we should process it
+        // Since this is a read-only operation, going beyond end of array will
+        // not corrupt memory.
+        outbuf[MAX_DIGITS - 1 - i] = s[i];  // Flip the bytes around MSB<->LSB
+      }
+      break;
+
+    default: // Send all zeroes for invalid mode. THIS SHOULD NEVER HAPPEN!
+      for (i = 0; i < MAX_DIGITS; i++) 
+        outbuf[i] = 0;
+      break;
+  }
+  if (ab_or_cd == CHIP_AB) {
     // Set the mode
     send_control(DATA_COMING, hexa_codeb_bit, decode_bit, power_state);
     // Send the data
     for (i = 0; i < MAX_DIGITS; i++) {
       send_byte(outbuf[i]);
-      // Copy the data sent to display into the object's internal storage
-      display_array[MAX_DIGITS - i - 1] = outbuf[i];
+      sent_array[i] = outbuf[i];
     }
+    sent_valid = 0xFF;
   }
+  else { // C or D chip variants. outbuf[i] is the data for digit address i
+    for (i = 0; i < MAX_DIGITS; i++) {
+      if ( !(sent_valid & (1 << i)) || (sent_array[i] != outbuf[i]) )
+        send_byte(outbuf[i], i);
+    }
+  }
+  // Copy the data sent to display into the object's internal storage
+  for (i = 0; i < MAX_DIGITS; i++)
+    display_array[MAX_DIGITS - i - 1] = outbuf[i];
 } // print(const char*)
 
 void ICM7218::print() {
@@ -303,55 +333,118 @@ void ICM7218::print() {
   }
   // Send the data bytes in reverse order
   for (int i = MAX_DIGITS - 1; i >= 0 ; i--) {
-    switch (mode) {
-      case HEXA:
-        display_digit = convertToHexa(display_array[i]);
-        display_digit |= ((dots<<i) & DP) ? 0 : DP;
-        break; 
-      case CODEB:
-        display_digit = convertToCodeB(display_array[i]);
-        display_digit |= ((dots<<i) & DP) ? 0 : DP;
-        break;
-      case DIRECT:
-        display_digit = display_array[i];
-        break;
-      default: // Send all 0's if invalid mode. This should never happen!
-        display_digit = 0;
-        break; 
-    }
+    display_digit = encode_digit(display_array[i], i);
     if (ab_or_cd == CHIP_AB) {
       send_byte(display_digit);
+      sent_array[MAX_DIGITS - i - 1] = display_digit;
     }
     else { // C or D chip variants
       send_byte(display_digit, MAX_DIGITS - i - 1);
     }
   }
+  sent_valid = 0xFF;
 }  // print()
 
 // For use with ICM7228 A/B Single Digit Update mode or ICM7218 C, D, ICM7228C update mode
 // pos is the array position, not the DIGIT#. That is, pos = 0 refers to left-most digit
 void ICM7218::print(byte c, byte pos) {
   if (pos > MAX_DIGITS - 1) pos = MAX_DIGITS - 1;
-  switch (mode) {
-    case HEXA:
-      c = convertToHexa(c);
-      c |= ((dots<<pos) & DP) ? 0 : DP;
-      break; 
-    case CODEB:
-      c = convertToCodeB(c);
-      c |= ((dots<<pos) & DP) ? 0 : DP;
-      break;
-    default: // Nothing to do for DIRECT mode
-      break; 
-  }  
-  if (ab_or_cd == CHIP_AB) {
-    send_control(NO_DATA_COMING, hexa_codeb_bit, decode_bit, power_state, MAX_DIGITS - pos - 1);
-    send_byte(c);
+  send_digit(encode_digit(c, pos), MAX_DIGITS - pos - 1);
+}  // print(char c, int pos)
+
+/* Carves the display into an independent region starting at array position
+   pos (0 = left-most digit) and len digits wide. Regions may not overlap.
+   Returns the region number to use with the other region methods, or
+   NO_REGION if the region does not fit or too many regions are defined.
+*/
+byte ICM7218::defineRegion(byte pos, byte len, JUSTIFY j) {
+  byte used = 0;
+  byte mask;
+  if ((num_regions >= MAX_REGIONS) || (len == 0) || (pos >= MAX_DIGITS) || (len > MAX_DIGITS - pos))
+    return NO_REGION;
+  for (byte r = 0; r < num_regions; r++)
+    used |= ((1 << region_len[r]) - 1) << region_pos[r];
+  mask = ((1 << len) - 1) << pos;
+  if (used & mask) return NO_REGION;
+  region_pos[num_regions] = pos;
+  region_len[num_regions] = len;
+  region_justify[num_regions] = j;
+  return num_regions++;
+}
+
+void ICM7218::clearRegions() {
+  num_regions = 0;
+}
+
+/* Sets the decimal points for a region without touching the other regions.
+   Bit 0 of d is the region's right-most digit, matching the .dots layout.
+*/
+void ICM7218::setRegionDots(byte region, byte d) {
+  byte shift, mask;
+  if (region >= num_regions) return;
+  shift = MAX_DIGITS - region_pos[region] - region_len[region];
+  mask = ((1 << region_len[region]) - 1) << shift;
+  dots = (dots & ~mask) | ((d << shift) & mask);
+}
+
+/* Copies the null-terminated string s into the region and updates the display.
+   Characters beyond the region width are dropped. Shorter strings are padded
+   on the right (LEFT_JUSTIFY) or left (RIGHT_JUSTIFY) with the default
+   character: blank in CODEB mode, 0 in HEXA mode.
+   In DIRECT mode, s holds segment values and padding is a blank segment value.
+   Unlike print(const char*), a 0x00 segment value ends the string, so use
+   operator [] and flushRegion() to display it.
+*/
+void ICM7218::printRegion(byte region, const char* s) {
+  byte pos, len, n, first, pad;
+  if (region >= num_regions) return;
+  pos = region_pos[region];
+  len = region_len[region];
+  for (n = 0; (n < len) && (s[n] != '\0'); n++) ;
+  first = (region_justify[region] == RIGHT_JUSTIFY) ? len - n : 0;
+  pad = (mode == DIRECT) ? (0 | DP) : ' ';
+  for (byte k = 0; k < len; k++) {
+    if ((k >= first) && (k < first + n))
+      display_array[pos + k] = s[k - first];
+    else
+      display_array[pos + k] = pad;
   }
-  else { // C or D chip variants
-    send_byte(c, MAX_DIGITS - pos - 1);
+  flushRegion(region);
+}
+
+/* Sends the region's digits from the internal character array to the display.
+   Chips with Single Digit Update (C/D variants, or ICM7228A/B and Maxim
+   ICM7218A/B after calling setSingleDigitUpdate(true)) only receive the
+   region's digits that differ from what was last sent. Intersil ICM7218A/B
+   can only update the whole display.
+*/
+void ICM7218::flushRegion(byte region) {
+  byte c, addr, first, last;
+  if (region >= num_regions) return;
+  if (!single_digit_update) {
+    // Intersil ICM7218A/B: burst the whole display, re-sending the other digits exactly
+    // as they were last sent. If those are not known, send display_array[].
+    if (sent_valid != 0xFF) {
+      print();
+      return;
+    }
+    first = MAX_DIGITS - region_pos[region] - region_len[region];  // Lowest address in region
+    last = MAX_DIGITS - region_pos[region] - 1;                    // Highest address in region
+    send_control(DATA_COMING, hexa_codeb_bit, decode_bit, power_state);
+    for (addr = 0; addr < MAX_DIGITS; addr++) {
+      if ((addr >= first) && (addr <= last))
+        sent_array[addr] = encode_digit(display_array[MAX_DIGITS - addr - 1], MAX_DIGITS - addr - 1);
+      send_byte(sent_array[addr]);
+    }
+    return;
   }
-}  // print(char c, int pos)
+  for (byte pos = region_pos[region]; pos < region_pos[region] + region_len[region]; pos++) {
+    c = encode_digit(display_array[pos], pos);
+    addr = MAX_DIGITS - pos - 1;
+    if ( !(sent_valid & (1 << addr)) || (sent_array[addr] != c) )
+      send_digit(c, addr);
+  }
+}
 
 
 void ICM7218::displayShutdown() {
@@ -503,6 +596,22 @@ void ICM7218::send_byte(byte c, byte pos) {
   // Latch in the data
   digitalWrite(write_out, LOW);
   digitalWrite(write_out, HIGH);
+  // Remember what this digit address now holds so unchanged digits can be skipped
+  sent_array[pos & 0x07] = c;
+  sent_valid |= 1 << (pos & 0x07);
+}
+
+// Writes one already encoded digit to digit address addr (0 = DIGIT1)
+void ICM7218::send_digit(byte c, byte addr) {
+  if (ab_or_cd == CHIP_AB) {
+    send_control(NO_DATA_COMING, hexa_codeb_bit, decode_bit, power_state, addr);
+    send_byte(c);
+    sent_array[addr] = c;
+    sent_valid |= 1 << addr;
+  }
+  else { // C or D chip variants
+    send_byte(c, addr);
+  }
 }
 
 void ICM7218::send_control(byte dc, byte hc, byte decode, byte sd, byte addr) {
@@ -522,6 +631,26 @@ void ICM7218::send_control(byte dc, byte hc, byte decode, byte sd, byte addr) {
   digitalWrite(write_out, HIGH);
 }
 
+// Converts character c for array position pos into the value sent to the chip
+byte ICM7218::encode_digit(byte c, byte pos) {
+  switch (mode) {
+    case HEXA:
+      c = convertToHexa(c);
+      c |= ((dots<<pos) & DP) ? 0 : DP;
+      break;
+    case CODEB:
+      c = convertToCodeB(c);
+      c |= ((dots<<pos) & DP) ? 0 : DP;
+      break;
+    case DIRECT:
+      break;
+    default: // Send all 0's if invalid mode. This should never happen!
+      c = 0;
+      break;
+  }
+  return c;
+}
+
 byte ICM7218::convertToCodeB(byte c) {
   byte display_digit;
   switch (c) {
@@ -20,6 +20,8 @@
                                renamed to ICM7218_segment_map
    1.3.0    08/24/2022  Andy4495 Add methods to simplify usage
    1.3.2    05-Dec-2023 Andy4495 Fix issues with C/D variants
+   1.4.0    18-Oct-2026 Andy4495 print(const char*) supports C/D variants
+                               Add display regions with per-region update
 */
 #ifndef ICM7218_LIBRARY
 #define ICM7218_LIBRARY
@@ -37,6 +39,8 @@ public:
   enum {NO_PIN=255};
   enum {DP = 128};
   enum RAM_BANK {RAM_BANK_A = 1, RAM_BANK_B = 0};
+  enum JUSTIFY {LEFT_JUSTIFY = 0, RIGHT_JUSTIFY = 1};
+  enum {NO_REGION = 255};
   byte dots;  // Only used with HEXA and CODEB with internal display_array or single char update
 // Constructor to use with the A or B variants of the chip.
   ICM7218(byte ID0_pin, byte ID1_pin, byte ID2_pin, byte ID3_pin,
@@ -51,6 +55,12 @@ public:
   void print(const char* s);
   void print(byte c, byte pos);  // For use with ICM7228 Single Digit Update mode
   void print();  // Sends data in display_array[] to the ICM7x18 chip
+  void setSingleDigitUpdate(bool enable);  // ICM7228A/B and Maxim ICM7218A/B only; C/D variants always update single digits
+  byte defineRegion(byte pos, byte len, JUSTIFY j = LEFT_JUSTIFY);  // Returns region number or NO_REGION
+  void clearRegions();
+  void setRegionDots(byte region, byte d);
+  void printRegion(byte region, const char* s);  // Copies s into the region and sends it to the display
+  void flushRegion(byte region);  // Sends only the region's digits from display_array[] to the display
   void displayShutdown();
   void displayWakeup();
   byte& operator [] (byte index);
@@ -67,15 +77,23 @@ private:
   enum {NO_DATA_COMING = 0, DATA_COMING = 1};
   enum {MAX_DIGITS = 8};
   enum {CHIP_AB = 0, CHIP_CD = 1};
+  enum {MAX_REGIONS = 4};
   byte d0_out, d1_out, d2_out, d3_out, d4_out, d5_out, d6_out, d7_out;
   byte mode_out;
   byte write_out;
   byte display_array[MAX_DIGITS];
   byte mode, decode_bit, hexa_codeb_bit, ram_bank_select, ab_or_cd;
   byte power_state;
+  byte sent_array[MAX_DIGITS];  // Last value written to each digit address
+  byte sent_valid;              // Bit n set once sent_array[n] is known
+  byte single_digit_update;
+  byte region_pos[MAX_REGIONS], region_len[MAX_REGIONS], region_justify[MAX_REGIONS];
+  byte num_regions;
   void send_byte(byte b);
   void send_byte(byte c, byte pos);
   void send_control(byte dc, byte hc, byte decode, byte sd, byte addr = 0);
+  void send_digit(byte c, byte addr);
+  byte encode_digit(byte c, byte pos);
   byte convertToCodeB(byte c);
   byte convertToHexa(byte c);
 };